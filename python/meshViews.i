@@ -0,0 +1,250 @@
+// numpy views over the vtk storage of a mesh, no data is copied. shared by
+// pyNemosys.i and pyNemosysSymmx.i, included after the meshBase declaration
+%{
+#define SWIG_FILE_WITH_INIT
+#include <numpy/arrayobject.h>
+#include <vtkDataArray.h>
+#include <vtkDoubleArray.h>
+#include <vtkPoints.h>
+#include <vtkPointSet.h>
+#include <vtkPointData.h>
+#include <vtkCellData.h>
+#include <vtkCellArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkPolyData.h>
+#include <cstring>
+
+// numpy type of a vtk data type, -1 if there is none
+static int vtkToNumpyType(int vtkType)
+{
+  switch (vtkType)
+  {
+    case VTK_FLOAT: return NPY_FLOAT32;
+    case VTK_DOUBLE: return NPY_FLOAT64;
+    case VTK_CHAR:
+    case VTK_SIGNED_CHAR: return NPY_INT8;
+    case VTK_UNSIGNED_CHAR: return NPY_UINT8;
+    case VTK_SHORT: return NPY_INT16;
+    case VTK_UNSIGNED_SHORT: return NPY_UINT16;
+    case VTK_INT: return NPY_INT32;
+    case VTK_UNSIGNED_INT: return NPY_UINT32;
+    case VTK_LONG: return NPY_LONG;
+    case VTK_UNSIGNED_LONG: return NPY_ULONG;
+    case VTK_LONG_LONG: return NPY_INT64;
+    case VTK_UNSIGNED_LONG_LONG: return NPY_UINT64;
+    case VTK_ID_TYPE: return sizeof(vtkIdType) == 8 ? NPY_INT64 : NPY_INT32;
+    default: return -1;
+  }
+}
+
+static void releaseVtkArray(PyObject* capsule)
+{
+  vtkDataArray* arr = (vtkDataArray*) PyCapsule_GetPointer(capsule, NULL);
+  if (arr)
+    arr->UnRegister(NULL);
+}
+
+// numpy array sharing the storage of arr, with one row per tuple, or 1D for
+// arrays with one component. the numpy array holds a reference to arr, so it
+// stays valid after the mesh is deleted, but not after arr is resized
+static PyObject* wrapDataArray(vtkDataArray* arr, bool writable)
+{
+  if (!arr)
+  {
+    PyErr_SetString(PyExc_ValueError, "no such array in the mesh");
+    return NULL;
+  }
+  int type = vtkToNumpyType(arr->GetDataType());
+  if (type < 0)
+  {
+    PyErr_SetString(PyExc_TypeError, "array type has no numpy equivalent");
+    return NULL;
+  }
+  int numComponents = arr->GetNumberOfComponents();
+  npy_intp dims[2] = {arr->GetNumberOfTuples(), numComponents};
+  PyObject* view = PyArray_SimpleNewFromData(numComponents == 1 ? 1 : 2, dims,
+                                             type, arr->GetVoidPointer(0));
+  if (!view)
+    return NULL;
+  if (!writable)
+    PyArray_CLEARFLAGS((PyArrayObject*) view, NPY_ARRAY_WRITEABLE);
+  PyObject* capsule = PyCapsule_New(arr, NULL, releaseVtkArray);
+  if (!capsule)
+  {
+    Py_DECREF(view);
+    return NULL;
+  }
+  arr->Register(NULL);
+  // steals the reference to capsule
+  if (PyArray_SetBaseObject((PyArrayObject*) view, capsule) < 0)
+  {
+    Py_DECREF(view);
+    return NULL;
+  }
+  return view;
+}
+
+// double array named name holding a copy of data, which must have numTuples
+// rows. null with a python error set otherwise
+static vtkSmartPointer<vtkDoubleArray> numpyToDataArray(const char* name,
+                                                        PyObject* data,
+                                                        int numTuples)
+{
+  PyArrayObject* arr
+    = (PyArrayObject*) PyArray_FROMANY(data, NPY_DOUBLE, 1, 2, NPY_ARRAY_IN_ARRAY);
+  if (!arr)
+    return NULL;
+  if (PyArray_DIM(arr, 0) != numTuples)
+  {
+    PyErr_Format(PyExc_ValueError, "expected %d rows of data, got %ld",
+                 numTuples, (long) PyArray_DIM(arr, 0));
+    Py_DECREF(arr);
+    return NULL;
+  }
+  int numComponents = PyArray_NDIM(arr) == 2 ? PyArray_DIM(arr, 1) : 1;
+  vtkSmartPointer<vtkDoubleArray> da = vtkSmartPointer<vtkDoubleArray>::New();
+  da->SetName(name);
+  da->SetNumberOfComponents(numComponents);
+  da->SetNumberOfTuples(numTuples);
+  std::memcpy(da->GetPointer(0), PyArray_DATA(arr),
+              sizeof(double)*numTuples*numComponents);
+  Py_DECREF(arr);
+  return da;
+}
+
+static vtkUnstructuredGrid* getUnstructuredGrid(meshBase* mesh)
+{
+  vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(mesh->getDataSet());
+  if (!ug)
+    PyErr_SetString(PyExc_TypeError, "mesh is not an unstructured grid");
+  return ug;
+}
+%}
+
+%init %{
+  import_array();
+%}
+
+
+// views share memory with the mesh. read-only views are returned by default,
+// writable ones change the mesh in place. bulk setters copy a numpy array, or
+// anything convertible to one, into a new double array of the mesh.
+// writing through a coordinate or cell view does not update vtk modification
+// times, so markGeometryModified must be called afterwards, or cached transfer
+// operators built for the old geometry are reused
+%extend meshBase {
+
+    // numPoints x 3 coordinates in their stored precision
+    PyObject* getPointCoordsView(bool writable = false)
+    {
+      vtkPointSet* ps = vtkPointSet::SafeDownCast($self->getDataSet());
+      if (!ps || !ps->GetPoints())
+      {
+        PyErr_SetString(PyExc_TypeError, "mesh has no explicit points");
+        return NULL;
+      }
+      return wrapDataArray(ps->GetPoints()->GetData(), writable);
+    }
+
+    // cell array in vtk layout: number of points of a cell followed by their ids
+    PyObject* getConnectivityView(bool writable = false)
+    {
+      vtkUnstructuredGrid* ug = getUnstructuredGrid($self);
+      return ug ? wrapDataArray(ug->GetCells()->GetData(), writable) : NULL;
+    }
+
+    // start of each cell in the connectivity view
+    PyObject* getCellLocationsView(bool writable = false)
+    {
+      vtkUnstructuredGrid* ug = getUnstructuredGrid($self);
+      return ug ? wrapDataArray(ug->GetCellLocationsArray(), writable) : NULL;
+    }
+
+    PyObject* getCellTypesView(bool writable = false)
+    {
+      vtkUnstructuredGrid* ug = getUnstructuredGrid($self);
+      return ug ? wrapDataArray(ug->GetCellTypesArray(), writable) : NULL;
+    }
+
+    PyObject* getPointDataView(int arrayID, bool writable = false)
+    {
+      return wrapDataArray($self->getDataSet()->GetPointData()->GetArray(arrayID),
+                           writable);
+    }
+
+    PyObject* getPointDataView(const std::string& name, bool writable = false)
+    {
+      return wrapDataArray(
+        $self->getDataSet()->GetPointData()->GetArray(name.c_str()), writable);
+    }
+
+    PyObject* getCellDataView(int arrayID, bool writable = false)
+    {
+      return wrapDataArray($self->getDataSet()->GetCellData()->GetArray(arrayID),
+                           writable);
+    }
+
+    PyObject* getCellDataView(const std::string& name, bool writable = false)
+    {
+      return wrapDataArray(
+        $self->getDataSet()->GetCellData()->GetArray(name.c_str()), writable);
+    }
+
+    // call after writing through getPointCoordsView, getConnectivityView,
+    // getCellLocationsView or getCellTypesView
+    void markGeometryModified()
+    {
+      vtkDataSet* ds = $self->getDataSet();
+      vtkPointSet* ps = vtkPointSet::SafeDownCast(ds);
+      if (ps && ps->GetPoints())
+      {
+        ps->GetPoints()->GetData()->Modified();
+        ps->GetPoints()->Modified();
+      }
+      if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(ds))
+      {
+        if (ug->GetCells())
+        {
+          ug->GetCells()->GetData()->Modified();
+          ug->GetCells()->Modified();
+        }
+        if (ug->GetCellLocationsArray())
+          ug->GetCellLocationsArray()->Modified();
+        if (ug->GetCellTypesArray())
+          ug->GetCellTypesArray()->Modified();
+      }
+      else if (vtkPolyData* pd = vtkPolyData::SafeDownCast(ds))
+      {
+        vtkCellArray* cellArrays[4]
+          = {pd->GetVerts(), pd->GetLines(), pd->GetPolys(), pd->GetStrips()};
+        for (int i = 0; i < 4; ++i)
+          if (cellArrays[i])
+            cellArrays[i]->Modified();
+      }
+      ds->Modified();
+    }
+
+    // data has one row per point
+    PyObject* setPointDataFromArray(const std::string& name, PyObject* data)
+    {
+      vtkSmartPointer<vtkDoubleArray> da
+        = numpyToDataArray(name.c_str(), data, $self->getNumberOfPoints());
+      if (!da)
+        return NULL;
+      $self->getDataSet()->GetPointData()->AddArray(da);
+      Py_RETURN_NONE;
+    }
+
+    // data has one row per cell
+    PyObject* setCellDataFromArray(const std::string& name, PyObject* data)
+    {
+      vtkSmartPointer<vtkDoubleArray> da
+        = numpyToDataArray(name.c_str(), data, $self->getNumberOfCells());
+      if (!da)
+        return NULL;
+      $self->getDataSet()->GetCellData()->AddArray(da);
+      Py_RETURN_NONE;
+    }
+};
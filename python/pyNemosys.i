@@ -15,6 +15,7 @@
 #include "jsoncons/json.hpp"
 #include "meshGen.H"
 #include "meshingParams.H"
+#include "meshPartitioner.H"
 %}
 
 
@@ -45,6 +46,8 @@ class meshBase
     static meshBase* extractSelectedCells(vtkSmartPointer<vtkDataSet> mesh,
                                           vtkSmartPointer<vtkIdTypeArray> cellIds);
     static meshBase* extractSelectedCells(meshBase* mesh, const std::vector<int>& cellIds);
+    static std::vector<std::shared_ptr<meshBase>> partition(const meshBase* mbObj, const int numPartitions,
+                                                            const std::vector<int>& cellWeights = std::vector<int>());
     virtual std::vector<double> getPoint(int id);
     virtual std::vector<std::vector<double>> getVertCrds() const;
     virtual std::map<int, std::vector<double>> getCell(int id);
@@ -94,7 +97,7 @@ class meshBase
     virtual void report();
     int getNumberOfPoints();
     int getNumberOfCells();
-    void checkMesh(std::string ofname);
+    void checkMesh(std::string ofname, bool writeCellQuality = false);
 
     virtual void write();
     virtual void write(std::string fname);
@@ -106,6 +109,8 @@ class meshBase
                     bool onlyVol);
     void writeMSH(std::string fname, std::string pointOrCell, int arrayID,
                     bool onlyVol);
+    void writeMSH(std::string fname, const std::vector<int>& pointArrayIDs,
+                  const std::vector<int>& cellArrayIDs, bool binary, double version = 2.2);
     void writeCobalt(meshBase* surfWithPatch, 
                      const std::string& mapFile, const std::string& ofname);
 
@@ -113,10 +118,15 @@ class meshBase
     std::string getFileName();
     void setCheckQuality(bool x);
     void setContBool(bool x);
+    void setNumThreads(int n);
+    int getNumThreads() const;
+    void clearTransferOperators();
     void setNewArrayNames(const std::vector<std::string>& newnames);
     void unsetNewArrayNames();
 };
 
+%include "meshViews.i"
+
 
 class vtkMesh : public meshBase
 {
@@ -179,11 +189,11 @@ class TransferDriver //: public NemDriver
   public:
 
     TransferDriver(std::string srcmsh, std::string trgmsh, std::string method,
-                   std::string ofname, bool checkQuality);
+                   std::string ofname, bool checkQuality, int numThreads = 1);
 
     TransferDriver(std::string srcmsh, std::string trgmsh, std::string method,
                    std::vector<std::string> arrayNames, std::string ofname,
-                   bool checkQuality);
+                   bool checkQuality, int numThreads = 1);
 
     ~TransferDriver();
 };
@@ -365,7 +375,8 @@ class MeshQualityDriver : public NemDriver
 {
   public:
 
-    MeshQualityDriver(std::string _mesh, std::string ofname);
+    MeshQualityDriver(std::string _mesh, std::string ofname,
+                      bool writeCellQuality = false, int numThreads = 1);
     ~MeshQualityDriver();
 
     static MeshQualityDriver* readJSON(json inputjson);
@@ -512,3 +523,23 @@ class meshGen
     vtkSmartPointer<vtkDataSet> getDataSet(); 
 };
 
+class meshPartitioner
+{
+
+public:
+  meshPartitioner(int nNde, int nElm, std::vector<int>& elemConn, MeshType_t meshType);
+  meshPartitioner(meshBase* inMB);
+  // destructor
+  ~meshPartitioner();
+
+  // mesh information
+  int partition(int nPartition);
+  int partition();
+  void setNumThreads(int n);
+  void setElmWeights(const std::vector<int>& wgt);
+  void setElmSizes(const std::vector<int>& sz);
+  std::vector<double> getCrds(int iPart, std::vector<double> crds);
+  std::vector<int> getConns(int iPart);
+  int getNNdePart(int iPart);
+  int getNElmPart(int iPart);
+};
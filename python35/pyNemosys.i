@@ -90,11 +90,11 @@ class TransferDriver //: public NemDriver
   public:
 
     TransferDriver(std::string srcmsh, std::string trgmsh, std::string method,
-                   std::string ofname, bool checkQuality);
+                   std::string ofname, bool checkQuality, int numThreads = 1);
 
     TransferDriver(std::string srcmsh, std::string trgmsh, std::string method,
                    std::vector<std::string> arrayNames, std::string ofname,
-                   bool checkQuality);
+                   bool checkQuality, int numThreads = 1);
 
     ~TransferDriver();
 };
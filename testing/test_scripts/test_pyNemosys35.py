@@ -38,6 +38,95 @@ class TestPyNemosys(unittest.TestCase):
             self.assertEqual(diffMesh(meshBase.Create(gold_output_file), meshBase.Create(output_file)), 0)
             self.assertEqual(diffMesh(meshBase.Create(gold_output_file), target), 0)
 
+    def testMeshBaseArrayViews(self):
+        from pyNemosys import meshBase
+        import numpy as np
+
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            os.chdir(tmpdirname)
+            path = '/Nemosys/testing/test_data/test_pyNemosys/transfer/'
+            for f in os.listdir(path):
+                copy2(os.path.join(path, f), tmpdirname)
+
+            with open('transfer.json', 'r') as jsonfile:
+                inputjson = json.load(jsonfile)
+
+            source_file = inputjson['Mesh File Options']['Input Mesh Files']['Source Mesh']
+            mesh = meshBase.Create(source_file)
+
+            crds = mesh.getPointCoordsView()
+            self.assertEqual(crds.shape, (mesh.getNumberOfPoints(), 3))
+            self.assertTrue(np.allclose(crds[1], mesh.getPoint(1)))
+            self.assertFalse(crds.flags.writeable)
+
+            conn = mesh.getConnectivityView()
+            locs = mesh.getCellLocationsView()
+            self.assertEqual(len(locs), mesh.getNumberOfCells())
+            npts = conn[locs[0]]
+            self.assertTrue(np.allclose(crds[conn[locs[0]+1:locs[0]+1+npts]],
+                                        mesh.getCellVec(0)))
+
+            wcrds = mesh.getPointCoordsView(True)
+            wcrds[0] += 1.0
+            self.assertTrue(np.allclose(crds[0], mesh.getPoint(0)))
+
+            mesh.setPointDataFromArray('ptIds', np.arange(mesh.getNumberOfPoints()))
+            ids = mesh.getPointDataView('ptIds')
+            self.assertEqual(ids[-1], mesh.getNumberOfPoints()-1)
+            mesh.setCellDataFromArray('cellVecs', np.ones((mesh.getNumberOfCells(), 3)))
+            self.assertEqual(mesh.getCellDataView('cellVecs').shape,
+                             (mesh.getNumberOfCells(), 3))
+            with self.assertRaises(ValueError):
+                mesh.setCellDataFromArray('bad', np.ones(mesh.getNumberOfCells()+1))
+            del mesh
+            self.assertEqual(ids[0], 0)
+
+
+    def testMeshBaseGeometryModified(self):
+        from pyNemosys import meshBase
+        import numpy as np
+
+        with tempfile.TemporaryDirectory() as tmpdirname:
+            os.chdir(tmpdirname)
+            path = '/Nemosys/testing/test_data/test_pyNemosys/transfer/'
+            for f in os.listdir(path):
+                copy2(os.path.join(path, f), tmpdirname)
+
+            with open('transfer.json', 'r') as jsonfile:
+                inputjson = json.load(jsonfile)
+
+            source_file   = inputjson['Mesh File Options']['Input Mesh Files']['Source Mesh']
+            target_file   = inputjson['Mesh File Options']['Input Mesh Files']['Target Mesh']
+            method_name   = inputjson['Transfer Options']['Method']
+            array_names   = inputjson['Transfer Options']['Array Names']
+
+            def transferred(mesh):
+                try:
+                    return np.array(mesh.getPointDataView(array_names[0]))
+                except ValueError:
+                    return np.array(mesh.getCellDataView(array_names[0]))
+
+            def stretch(mesh):
+                crds = mesh.getPointCoordsView(True)
+                crds[:, 0] = 1.5*crds[:, 0] - 0.1
+                mesh.markGeometryModified()
+
+            # the cached operator must be rebuilt after the source is moved
+            source = meshBase.Create(source_file)
+            target = meshBase.Create(target_file)
+            source.transfer(target, method_name, array_names)
+            before = transferred(target)
+            stretch(source)
+            source.transfer(target, method_name, array_names)
+
+            fresh_source = meshBase.Create(source_file)
+            fresh_target = meshBase.Create(target_file)
+            stretch(fresh_source)
+            fresh_source.transfer(fresh_target, method_name, array_names)
+
+            self.assertTrue(np.allclose(transferred(target), transferred(fresh_target)))
+            self.assertFalse(np.allclose(transferred(target), before))
+
 
     def testTransferDriver(self):
         from pyNemosys import meshBase, TransferDriver, diffMesh